@@ -0,0 +1,286 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "/root/repo/cmake/CheckOpenMPVersion.cmake"
+  "/root/repo/cmake/ChronoConfig.cmake.in"
+  "/root/repo/cmake/FindAVX.cmake"
+  "/root/repo/cmake/FindModernCXX.cmake"
+  "/root/repo/cmake/FindSSE.cmake"
+  "/root/repo/cmake/GetGitRevisionDescription.cmake"
+  "/root/repo/cmake/GetGitRevisionDescription.cmake.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/chrono/CMakeLists.txt"
+  "/root/repo/src/chrono/ChConfig.h.in"
+  "/root/repo/src/chrono/ChVersion.h.in"
+  "/root/repo/src/chrono_cascade/CMakeLists.txt"
+  "/root/repo/src/chrono_cosimulation/CMakeLists.txt"
+  "/root/repo/src/chrono_fea/CMakeLists.txt"
+  "/root/repo/src/chrono_irrlicht/CMakeLists.txt"
+  "/root/repo/src/chrono_matlab/CMakeLists.txt"
+  "/root/repo/src/chrono_mkl/CMakeLists.txt"
+  "/root/repo/src/chrono_opengl/CMakeLists.txt"
+  "/root/repo/src/chrono_parallel/CMakeLists.txt"
+  "/root/repo/src/chrono_postprocess/CMakeLists.txt"
+  "/root/repo/src/chrono_python/CMakeLists.txt"
+  "/root/repo/src/chrono_vehicle/CMakeLists.txt"
+  "/root/repo/src/chrono_vehicle/ChConfigVehicle.h.in"
+  "/root/repo/src/demos/CMakeLists.txt"
+  "/root/repo/src/demos/basics/CMakeLists.txt"
+  "/root/repo/src/demos/core/CMakeLists.txt"
+  "/root/repo/src/demos/cosimulation/CMakeLists.txt"
+  "/root/repo/src/demos/fea/CMakeLists.txt"
+  "/root/repo/src/demos/lcp_solver/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_ArticulatedVehicle/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_DeformableSoil/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_GenericVehicle/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_HMMWV/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_HMMWV9/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_HMMWV_Batch/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_HMMWV_DeformableSoil/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_M113/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_M113_DeformableSoil/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_M113_Parallel/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_SteeringController/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_SuspensionTest/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_TrackTestRig/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_Vehicle/CMakeLists.txt"
+  "/root/repo/src/demos/vehicle/demo_WheeledVehicleAssembly/CMakeLists.txt"
+  "/root/repo/src/tests/CMakeLists.txt"
+  "/root/repo/src/tests/contact/CMakeLists.txt"
+  "/root/repo/src/tests/fea/CMakeLists.txt"
+  "/root/repo/src/tests/physics/CMakeLists.txt"
+  "/root/repo/src/tests/timestepper/CMakeLists.txt"
+  "/root/repo/src/tests/vehicle/CMakeLists.txt"
+  "/root/repo/src/tests/vehicle/test_pacjekaTire/CMakeLists.txt"
+  "/root/repo/src/tests/vehicle/test_sprocket/CMakeLists.txt"
+  "/root/repo/src/tests/vehicle/test_steeringControl/CMakeLists.txt"
+  "/root/repo/src/tests/vehicle/test_toroidalTire/CMakeLists.txt"
+  "/root/repo/src/tests/vehicle/tire_testRig/CMakeLists.txt"
+  "/root/repo/src/unit_tests/CMakeLists.txt"
+  "/root/repo/src/unit_tests/benchmark/CMakeLists.txt"
+  "/root/repo/src/unit_tests/core/CMakeLists.txt"
+  "/root/repo/src/unit_tests/fea/CMakeLists.txt"
+  "/root/repo/src/unit_tests/physics/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/git-data/HEAD"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "CMakeFiles/git-data/head-ref"
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "chrono/ChConfig.h"
+  "chrono/ChVersion.h"
+  "cmake/ChronoConfig.cmake"
+  "cmake/ChronoConfig.cmake.install"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_mkl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_matlab/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_cascade/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_irrlicht/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_postprocess/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_cosimulation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_fea/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_python/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_parallel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/chrono_opengl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "chrono_vehicle/ChConfigVehicle.h"
+  "src/chrono_vehicle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/basics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/lcp_solver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/fea/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/cosimulation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_HMMWV9/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_HMMWV/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_HMMWV_Batch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_GenericVehicle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_Vehicle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_SuspensionTest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_ArticulatedVehicle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_WheeledVehicleAssembly/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_SteeringController/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_DeformableSoil/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_M113/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_M113_DeformableSoil/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_M113_Parallel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_TrackTestRig/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/demos/vehicle/demo_HMMWV_DeformableSoil/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/unit_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/unit_tests/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/unit_tests/physics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/unit_tests/fea/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/timestepper/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/contact/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/physics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/fea/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/vehicle/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/vehicle/tire_testRig/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/vehicle/test_toroidalTire/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/vehicle/test_pacjekaTire/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/vehicle/test_steeringControl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/vehicle/test_sprocket/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/chrono/CMakeFiles/ChronoEngine.dir/DependInfo.cmake"
+  "src/chrono_cosimulation/CMakeFiles/ChronoEngine_cosimulation.dir/DependInfo.cmake"
+  "src/chrono_fea/CMakeFiles/ChronoEngine_fea.dir/DependInfo.cmake"
+  "src/chrono_vehicle/CMakeFiles/ChronoEngine_vehicle.dir/DependInfo.cmake"
+  "src/demos/basics/CMakeFiles/demo_buildsystem.dir/DependInfo.cmake"
+  "src/demos/basics/CMakeFiles/demo_powertrain.dir/DependInfo.cmake"
+  "src/demos/basics/CMakeFiles/demo_chfunctions.dir/DependInfo.cmake"
+  "src/demos/core/CMakeFiles/demo_coords.dir/DependInfo.cmake"
+  "src/demos/core/CMakeFiles/demo_math.dir/DependInfo.cmake"
+  "src/demos/core/CMakeFiles/demo_stream.dir/DependInfo.cmake"
+  "src/demos/core/CMakeFiles/demo_archive.dir/DependInfo.cmake"
+  "src/demos/lcp_solver/CMakeFiles/demo_LCPsolver.dir/DependInfo.cmake"
+  "src/demos/fea/CMakeFiles/demo_FEA_basic.dir/DependInfo.cmake"
+  "src/demos/fea/CMakeFiles/demo_FEA_dynamics.dir/DependInfo.cmake"
+  "src/demos/fea/CMakeFiles/demo_FEA_loads.dir/DependInfo.cmake"
+  "src/demos/cosimulation/CMakeFiles/demo_socket.dir/DependInfo.cmake"
+  "src/demos/cosimulation/CMakeFiles/demo_cosimulation.dir/DependInfo.cmake"
+  "src/demos/cosimulation/CMakeFiles/demo_cosim_hydraulics.dir/DependInfo.cmake"
+  "src/demos/cosimulation/CMakeFiles/demo_cosim_loopback.dir/DependInfo.cmake"
+  "src/demos/vehicle/demo_HMMWV_Batch/CMakeFiles/demo_VEH_HMMWV_Batch.dir/DependInfo.cmake"
+  "src/demos/vehicle/demo_GenericVehicle/CMakeFiles/demo_VEH_GenericVehicle.dir/DependInfo.cmake"
+  "src/demos/vehicle/demo_Vehicle/CMakeFiles/demo_VEH_VehicleJSON.dir/DependInfo.cmake"
+  "src/demos/vehicle/demo_ArticulatedVehicle/CMakeFiles/demo_VEH_ArticulatedVehicle.dir/DependInfo.cmake"
+  "src/unit_tests/core/CMakeFiles/utest_CH_ChVector.dir/DependInfo.cmake"
+  "src/unit_tests/core/CMakeFiles/utest_CH_coords.dir/DependInfo.cmake"
+  "src/unit_tests/core/CMakeFiles/utest_CH_math.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_atomic.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_bezier.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_ChBody.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_checkpoint.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_columnar.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_hull_cache.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_mesh_cache.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_narrowphase.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_neighbor_grid.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_recorder.dir/DependInfo.cmake"
+  "src/unit_tests/benchmark/CMakeFiles/utest_CH_benchmark_shapecache.dir/DependInfo.cmake"
+  "src/unit_tests/physics/CMakeFiles/utest_CH_slider_pend.dir/DependInfo.cmake"
+  "src/unit_tests/physics/CMakeFiles/utest_CH_double_pend.dir/DependInfo.cmake"
+  "src/unit_tests/physics/CMakeFiles/utest_CH_compute_contact.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_ANCFBeam.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_ANCFShell_Iso.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_ANCFShell_Ort.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_ANCFShell_OrtGrav.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_EASBrickIso.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_EASBrickIso_Grav.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_EASBrickMooneyR_Grav.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_ANCFConstraints.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_ANCFContact.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_compute_contact_mesh.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_contact_surface_bvh.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_benchmark_gauss_tables.dir/DependInfo.cmake"
+  "src/unit_tests/fea/CMakeFiles/utest_FEA_benchmark_ancf_batch.dir/DependInfo.cmake"
+  "src/tests/timestepper/CMakeFiles/test_CH_integratorHHT.dir/DependInfo.cmake"
+  "src/tests/fea/CMakeFiles/test_FEA_shellANCF.dir/DependInfo.cmake"
+  "src/tests/fea/CMakeFiles/test_FEA_4HumveeTires.dir/DependInfo.cmake"
+  "src/tests/fea/CMakeFiles/test_FEA_CorotationalTire.dir/DependInfo.cmake"
+  "src/tests/fea/CMakeFiles/test_FEA_ANCFHumveeTire.dir/DependInfo.cmake"
+  "src/tests/vehicle/test_pacjekaTire/CMakeFiles/test_VEH_tirePacejka.dir/DependInfo.cmake"
+  "src/tests/vehicle/test_pacjekaTire/CMakeFiles/test_VEH_updatePacejka.dir/DependInfo.cmake"
+  "src/tests/vehicle/test_steeringControl/CMakeFiles/test_VEH_SteeringControl.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,26 @@
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 Project Chrono
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file at the top level of the distribution
+// and at http://projectchrono.org/license-chrono.txt.
+//
+//
+// \author Andrew Seidl <dev@aas.io>
+//
+
+#ifndef CORE_VERSION_H_
+#define CORE_VERSION_H_
+
+// TODO: #define in a header forces major recompile, move to .cpp?
+
+#define CHRONOENGINE_VCS_REVISION "f6bc58333453235636f2c82866461665aa3387f9"
+
+#define CHRONOENGINE_VERSION "2.0.0"
+#define CHRONOENGINE_VERSION_MAJOR "2"
+#define CHRONOENGINE_VERSION_MINOR "0"
+#define CHRONOENGINE_VERSION_PATCH "0"
+
+#endif  // CORE_VERSION_H_
@@ -0,0 +1,33 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Chrono-Vehicle configuration header file
+//
+// Automatically created during CMake configuration.
+//
+// =============================================================================
+
+#ifndef CH_CONFIG_VEHICLE_H
+#define CH_CONFIG_VEHICLE_H
+
+// Include main Chrono configuration header
+#include "chrono/ChConfig.h"
+
+// -----------------------------------------------------------------------------
+
+// If Irrklang suppport was enabled, define CHRONO_IRRKLANG
+#undef CHRONO_IRRKLANG
+
+
+#endif